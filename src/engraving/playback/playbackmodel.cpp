@@ -76,13 +76,13 @@ void PlaybackModel::reload()
     clearExpiredContexts();
 
     for (auto& pair : m_playbackDataMap) {
-        pair.second.originEvents.clear();
+        pair.second->originEvents.clear();
     }
 
     update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
 
     for (auto& pair : m_playbackDataMap) {
-        pair.second.mainStream.send(pair.second.originEvents);
+        pair.second->mainStream.send(pair.second->originEvents);
     }
 }
 
@@ -106,7 +106,7 @@ const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const InstrumentTrac
     auto search = m_playbackDataMap.find(trackId);
 
     if (search != m_playbackDataMap.cend()) {
-        return search->second;
+        return *search->second;
     }
 
     const Ms::Part* part = m_score->partById(trackId.partId.toUint64());
@@ -118,7 +118,7 @@ const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const InstrumentTrac
 
     update(0, m_score->lastMeasure()->tick().ticks(), part->startTrack(), part->endTrack());
 
-    return m_playbackDataMap[trackId];
+    return ensurePlaybackData(trackId);
 }
 
 const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const ID& partId, const std::string& instrumentId)
@@ -146,7 +146,7 @@ void PlaybackModel::triggerEventsForItem(const Ms::EngravingItem* item)
     int utick = repeatList().tick2utick(item->tick().ticks());
     timestamp_t timestamp = timestampFromTicks(item->score(), utick);
 
-    const PlaybackEventList& eventsFromTick = trackPlaybackData->second.originEvents.at(timestamp);
+    const PlaybackEventList& eventsFromTick = trackPlaybackData->second->originEvents.at(timestamp);
 
     PlaybackEventsMap result;
 
@@ -167,7 +167,7 @@ void PlaybackModel::triggerEventsForItem(const Ms::EngravingItem* item)
         noteEvent.setFixedDuration(Ms::MScore::defaultPlayDuration);
     }
 
-    trackPlaybackData->second.offStream.send(std::move(result));
+    trackPlaybackData->second->offStream.send(std::move(result));
 }
 
 void PlaybackModel::update(const int tickFrom, const int tickTo, const int trackFrom, const int trackTo,
@@ -179,6 +179,14 @@ void PlaybackModel::update(const int tickFrom, const int tickTo, const int track
 
 void PlaybackModel::updateSetupData()
 {
+    size_t expectedTrackCount = 1; // the metronome track
+    for (const Ms::Part* part : m_score->parts()) {
+        expectedTrackCount += part->instruments()->size();
+    }
+
+    m_playbackDataMap.reserve(expectedTrackCount);
+    m_playbackCtxMap.reserve(expectedTrackCount);
+
     for (const Ms::Part* part : m_score->parts()) {
         for (const auto& pair : *part->instruments()) {
             InstrumentTrackId trackId = idKey(part->id(), pair.second->id().toStdString());
@@ -187,11 +195,11 @@ void PlaybackModel::updateSetupData()
                 continue;
             }
 
-            m_setupResolver.resolveSetupData(pair.second, m_playbackDataMap[std::move(trackId)].setupData);
+            m_setupResolver.resolveSetupData(pair.second, ensurePlaybackData(trackId).setupData);
         }
     }
 
-    m_setupResolver.resolveMetronomeSetupData(m_playbackDataMap[METRONOME_TRACK_ID].setupData);
+    m_setupResolver.resolveMetronomeSetupData(ensurePlaybackData(METRONOME_TRACK_ID).setupData);
 }
 
 void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const int trackFrom, const int trackTo,
@@ -238,10 +246,12 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const int
                         continue;
                     }
 
-                    PlaybackContext& ctx = m_playbackCtxMap[trackId];
+                    PlaybackContext& ctx = ensurePlaybackContext(trackId);
                     ctx.update(segment, segmentPositionTick);
 
-                    ArticulationsProfilePtr profile = profilesRepository()->defaultProfile(m_playbackDataMap[trackId].setupData.category);
+                    PlaybackData& trackData = ensurePlaybackData(trackId);
+
+                    ArticulationsProfilePtr profile = profilesRepository()->defaultProfile(trackData.setupData.category);
                     if (!profile) {
                         LOGE() << "unsupported instrument family: " << item->part()->id();
                         continue;
@@ -249,13 +259,13 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const int
 
                     m_renderer.render(item, tickPositionOffset, ctx.nominalDynamicLevel(segmentPositionTick),
                                       ctx.persistentArticulationType(segmentPositionTick), std::move(profile),
-                                      m_playbackDataMap[trackId].originEvents);
+                                      trackData.originEvents);
 
                     collectChangesTracks(trackId, trackChanges);
                 }
 
                 m_renderer.renderMetronome(m_score, segmentPositionTick, segment->ticks().ticks(),
-                                           tickPositionOffset, m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
+                                           tickPositionOffset, ensurePlaybackData(METRONOME_TRACK_ID).originEvents);
                 collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
             }
         }
@@ -276,6 +286,7 @@ void PlaybackModel::clearExpiredTracks()
         const Ms::Part* part = m_score->partById(it->first.partId.toUint64());
 
         if (!part || part->instruments()->contains(it->first.instrumentId)) {
+            m_playbackDataPool.free(it->second);
             it = m_playbackDataMap.erase(it);
             continue;
         }
@@ -298,6 +309,7 @@ void PlaybackModel::clearExpiredContexts()
         const Ms::Part* part = m_score->partById(it->first.partId.toUint64());
 
         if (!part || part->instruments()->contains(it->first.instrumentId)) {
+            m_playbackCtxPool.free(it->second);
             it = m_playbackCtxMap.erase(it);
             continue;
         }
@@ -341,13 +353,18 @@ void PlaybackModel::notifyAboutChanges(ChangedTrackIdSet&& trackChanges)
             continue;
         }
 
-        search->second.mainStream.send(search->second.originEvents);
+        search->second->mainStream.send(search->second->originEvents);
     }
 }
 
 void PlaybackModel::removeEvents(const InstrumentTrackId& trackId, const mpe::timestamp_t timestamp)
 {
-    PlaybackData& trackPlaybackData = m_playbackDataMap[trackId];
+    auto trackSearch = m_playbackDataMap.find(trackId);
+    if (trackSearch == m_playbackDataMap.cend()) {
+        return;
+    }
+
+    PlaybackData& trackPlaybackData = *trackSearch->second;
 
     auto search = trackPlaybackData.originEvents.find(timestamp);
     if (search != trackPlaybackData.originEvents.cend()) {
@@ -355,6 +372,28 @@ void PlaybackModel::removeEvents(const InstrumentTrackId& trackId, const mpe::ti
     }
 }
 
+PlaybackContext& PlaybackModel::ensurePlaybackContext(const InstrumentTrackId& trackId)
+{
+    PlaybackContext*& ctx = m_playbackCtxMap[trackId];
+
+    if (!ctx) {
+        ctx = m_playbackCtxPool.alloc();
+    }
+
+    return *ctx;
+}
+
+mpe::PlaybackData& PlaybackModel::ensurePlaybackData(const InstrumentTrackId& trackId)
+{
+    mpe::PlaybackData*& data = m_playbackDataMap[trackId];
+
+    if (!data) {
+        data = m_playbackDataPool.alloc();
+    }
+
+    return *data;
+}
+
 void PlaybackModel::findEventsForNote(const Ms::Note* note, const mpe::PlaybackEventList& sourceEvents,
                                       mpe::PlaybackEventList& result) const
 {
@@ -23,12 +23,13 @@
 #ifndef MU_ENGRAVING_PLAYBACKMODEL_H
 #define MU_ENGRAVING_PLAYBACKMODEL_H
 
-#include <unordered_map>
 #include <map>
 #include <functional>
 
 #include "async/asyncable.h"
 #include "async/channel.h"
+#include "fixedpoolallocator.h"
+#include "flathashmap.h"
 #include "id.h"
 #include "modularity/ioc.h"
 #include "mpe/events.h"
@@ -86,6 +87,9 @@ private:
 
     void removeEvents(const InstrumentTrackId& trackId, const mpe::timestamp_t timestamp);
 
+    PlaybackContext& ensurePlaybackContext(const InstrumentTrackId& trackId);
+    mpe::PlaybackData& ensurePlaybackData(const InstrumentTrackId& trackId);
+
     void findEventsForNote(const Ms::Note* note, const mpe::PlaybackEventList& sourceEvents, mpe::PlaybackEventList& result) const;
 
     const Ms::RepeatList& repeatList() const;
@@ -96,8 +100,12 @@ private:
     PlaybackEventsRenderer m_renderer;
     PlaybackSetupDataResolver m_setupResolver;
 
-    std::unordered_map<InstrumentTrackId, PlaybackContext> m_playbackCtxMap;
-    std::unordered_map<InstrumentTrackId, mpe::PlaybackData> m_playbackDataMap;
+    //! NOTE the pools must outlive the maps: map entries point into pool slots
+    FixedPoolAllocator<PlaybackContext> m_playbackCtxPool;
+    FixedPoolAllocator<mpe::PlaybackData> m_playbackDataPool;
+
+    FlatHashMap<InstrumentTrackId, PlaybackContext*> m_playbackCtxMap;
+    FlatHashMap<InstrumentTrackId, mpe::PlaybackData*> m_playbackDataMap;
 };
 }
 
@@ -20,6 +20,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <functional>
 #include <unordered_set>
@@ -569,13 +573,55 @@ enum class ChordLineType : char {
     PLOP, SCOOP
 };
 
+//! NOTE instrument ids come from a small fixed set, so they are interned into a
+//! dense index; comparing and hashing track ids then never has to walk the string
+class InstrumentIdInterner
+{
+public:
+    static uint32_t intern(const std::string& instrumentId)
+    {
+        static std::mutex mutex;
+        //! NOTE the empty id is pre-interned as 0, so that a default-constructed
+        //! InstrumentTrackId compares equal to an explicitly empty one
+        static std::unordered_map<std::string, uint32_t> indices { { std::string(), 0 } };
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto search = indices.find(instrumentId);
+        if (search != indices.cend()) {
+            return search->second;
+        }
+
+        uint32_t index = static_cast<uint32_t>(indices.size());
+        indices.insert({ instrumentId, index });
+
+        return index;
+    }
+};
+
 struct InstrumentTrackId {
     ID partId = 0;
     std::string instrumentId;
 
+    InstrumentTrackId() = default;
+
+    InstrumentTrackId(const ID& partId, const std::string& instrumentId)
+        : partId(partId), instrumentId(instrumentId),
+        m_key((partId.toUint64() << 32) | InstrumentIdInterner::intern(instrumentId))
+    {
+    }
+
+    //! NOTE (partId, interned instrument index) packed into one word for hashing;
+    //! the public fields are set by the constructor and must not be mutated piecewise
+    uint64_t key() const
+    {
+        return m_key;
+    }
+
     bool operator ==(const InstrumentTrackId& other) const
     {
-        return partId == other.partId && instrumentId == other.instrumentId;
+        return partId == other.partId
+               && static_cast<uint32_t>(m_key) == static_cast<uint32_t>(other.m_key);
     }
 
     bool operator <(const InstrumentTrackId& other) const noexcept
@@ -591,6 +637,9 @@ struct InstrumentTrackId {
     {
         return partId.isValid() && !instrumentId.empty();
     }
+
+private:
+    uint64_t m_key = 0;
 };
 
 using InstrumentTrackIdSet = std::unordered_set<InstrumentTrackId>;
@@ -601,9 +650,12 @@ struct std::hash<mu::engraving::InstrumentTrackId>
 {
     std::size_t operator()(const mu::engraving::InstrumentTrackId& s) const noexcept
     {
-        std::size_t h1 = std::hash<int> {}(s.partId.toUint64());
-        std::size_t h2 = std::hash<std::string> {}(s.instrumentId);
-        return h1 ^ (h2 << 1);
+        //! NOTE single mix of the packed 64-bit key instead of walking the string
+        uint64_t h = s.key();
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
     }
 };
 
@@ -23,6 +23,7 @@
 #define MU_ACTIONS_ACTIONSDISPATCHER_H
 
 #include <map>
+#include <unordered_map>
 
 #include "../iactionsdispatcher.h"
 
@@ -44,7 +45,9 @@ private:
     using CallBacks = std::map<ActionCode, ActionCallBackWithNameAndData>;
     using Clients = std::map<Actionable*, CallBacks>;
 
-    std::map<ActionCode, Clients > m_clients;
+    //! NOTE every dispatch starts with a lookup by action code, so the registry
+    //! is hashed instead of ordered; mapped references stay stable on insert
+    std::unordered_map<ActionCode, Clients> m_clients;
 };
 }
 
@@ -27,6 +27,8 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "realfn.h"
 #include "midi/miditypes.h"
@@ -176,6 +178,8 @@ struct AudioOutputParams {
     }
 };
 
+using TrackAudioOutputParamsList = std::vector<std::pair<TrackId, AudioOutputParams> >;
+
 enum class AudioSourceType {
     Undefined = -1,
     Fluid,
@@ -38,6 +38,8 @@ public:
 
     virtual async::Promise<AudioOutputParams> outputParams(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
     virtual void setOutputParams(const TrackSequenceId sequenceId, const TrackId trackId, const AudioOutputParams& params) = 0;
+    //! NOTE applies all updates in a single round trip to the audio worker
+    virtual void setOutputParams(const TrackSequenceId sequenceId, const TrackAudioOutputParamsList& paramsList) = 0;
     virtual async::Channel<TrackSequenceId, TrackId, AudioOutputParams> outputParamsChanged() const = 0;
 
     virtual async::Promise<AudioOutputParams> masterOutputParams() const = 0;
@@ -78,6 +78,27 @@ void AudioOutputHandler::setOutputParams(const TrackSequenceId sequenceId, const
     }, AudioThread::ID);
 }
 
+void AudioOutputHandler::setOutputParams(const TrackSequenceId sequenceId, const TrackAudioOutputParamsList& paramsList)
+{
+    if (paramsList.empty()) {
+        return;
+    }
+
+    Async::call(this, [this, sequenceId, paramsList]() {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        ITrackSequencePtr s = sequence(sequenceId);
+
+        if (!s) {
+            return;
+        }
+
+        for (const auto& pair : paramsList) {
+            s->audioIO()->setOutputParams(pair.first, pair.second);
+        }
+    }, AudioThread::ID);
+}
+
 Channel<TrackSequenceId, TrackId, AudioOutputParams> AudioOutputHandler::outputParamsChanged() const
 {
     ONLY_AUDIO_MAIN_OR_WORKER_THREAD;
@@ -41,6 +41,7 @@ public:
 
     async::Promise<AudioOutputParams> outputParams(const TrackSequenceId sequenceId, const TrackId trackId) const override;
     void setOutputParams(const TrackSequenceId sequenceId, const TrackId trackId, const AudioOutputParams& params) override;
+    void setOutputParams(const TrackSequenceId sequenceId, const TrackAudioOutputParamsList& paramsList) override;
     async::Channel<TrackSequenceId, TrackId, AudioOutputParams> outputParamsChanged() const override;
 
     async::Promise<AudioOutputParams> masterOutputParams() const override;
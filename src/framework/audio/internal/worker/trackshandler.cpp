@@ -138,6 +138,27 @@ void TracksHandler::removeTrack(const TrackSequenceId sequenceId, const TrackId
     }, AudioThread::ID);
 }
 
+void TracksHandler::removeTracks(const TrackSequenceId sequenceId, const TrackIdList& trackIdList)
+{
+    if (trackIdList.empty()) {
+        return;
+    }
+
+    Async::call(this, [this, sequenceId, trackIdList]() {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        ITrackSequencePtr s = sequence(sequenceId);
+
+        if (!s) {
+            return;
+        }
+
+        for (const TrackId& id : trackIdList) {
+            s->removeTrack(id);
+        }
+    }, AudioThread::ID);
+}
+
 void TracksHandler::removeAllTracks(const TrackSequenceId sequenceId)
 {
     Async::call(this, [this, sequenceId]() {
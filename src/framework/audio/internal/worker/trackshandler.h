@@ -45,6 +45,7 @@ public:
     async::Promise<TrackId, AudioParams> addTrack(const TrackSequenceId sequenceId, const std::string& trackName,
                                                   const mpe::PlaybackData& playbackData, AudioParams&& params) override;
     void removeTrack(const TrackSequenceId sequenceId, const TrackId trackId) override;
+    void removeTracks(const TrackSequenceId sequenceId, const TrackIdList& trackIdList) override;
     void removeAllTracks(const TrackSequenceId sequenceId) override;
 
     async::Channel<TrackSequenceId, TrackId> trackAdded() const override;
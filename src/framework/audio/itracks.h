@@ -45,6 +45,9 @@ public:
     virtual async::Promise<TrackId, AudioParams> addTrack(const TrackSequenceId sequenceId, const std::string& trackName,
                                                           const mpe::PlaybackData& playbackData, AudioParams&& params) = 0;
     virtual void removeTrack(const TrackSequenceId sequenceId, const TrackId trackId) = 0;
+
+    //! NOTE removes all listed tracks in a single round trip to the audio worker
+    virtual void removeTracks(const TrackSequenceId sequenceId, const TrackIdList& trackIdList) = 0;
     virtual void removeAllTracks(const TrackSequenceId sequenceId) = 0;
 
     virtual async::Channel<TrackSequenceId, TrackId> trackAdded() const = 0;
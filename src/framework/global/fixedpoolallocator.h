@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_FRAMEWORK_FIXEDPOOLALLOCATOR_H
+#define MU_FRAMEWORK_FIXEDPOOLALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mu {
+//! NOTE Freelist-based object pool for types that are created and destroyed often
+//! (e.g. per-track playback payloads that churn during editing).
+//! Objects are carved out of fixed-size blocks, so alloc/free is O(1), does not
+//! go through the system allocator in the steady state and returns stable
+//! pointers (freeing one object never moves another one).
+//! The freelist is threaded through the unused slots themselves: a free slot
+//! stores the index of the next free slot in its first bytes.
+//! Objects still alive when the pool is destroyed are destroyed with it.
+template<typename T, size_t BlockSize = 32>
+class FixedPoolAllocator
+{
+public:
+    FixedPoolAllocator() = default;
+
+    FixedPoolAllocator(const FixedPoolAllocator&) = delete;
+    FixedPoolAllocator& operator=(const FixedPoolAllocator&) = delete;
+
+    ~FixedPoolAllocator()
+    {
+        for (size_t i = 0; i < m_used.size(); ++i) {
+            if (m_used[i]) {
+                objectAt(static_cast<uint32_t>(i))->~T();
+            }
+        }
+
+        for (Slot* block : m_blocks) {
+            delete[] block;
+        }
+    }
+
+    template<typename ... Args>
+    T* alloc(Args&& ... args)
+    {
+        if (m_freeHead == NO_INDEX) {
+            addBlock();
+        }
+
+        uint32_t index = m_freeHead;
+        Slot* slot = slotAt(index);
+        m_freeHead = nextFreeIndex(slot);
+        m_used[index] = true;
+
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    void free(T* object)
+    {
+        if (!object) {
+            return;
+        }
+
+        uint32_t index = indexOf(object);
+        object->~T();
+
+        Slot* slot = slotAt(index);
+        nextFreeIndex(slot) = m_freeHead;
+        m_freeHead = index;
+        m_used[index] = false;
+    }
+
+private:
+    static constexpr uint32_t NO_INDEX = static_cast<uint32_t>(-1);
+
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    static_assert(sizeof(T) >= sizeof(uint32_t), "slot must be able to hold a freelist index");
+    static_assert(BlockSize > 0, "block must hold at least one slot");
+
+    Slot* slotAt(uint32_t index)
+    {
+        return m_blocks[index / BlockSize] + (index % BlockSize);
+    }
+
+    T* objectAt(uint32_t index)
+    {
+        return reinterpret_cast<T*>(slotAt(index)->storage);
+    }
+
+    static uint32_t& nextFreeIndex(Slot* slot)
+    {
+        return *reinterpret_cast<uint32_t*>(slot->storage);
+    }
+
+    uint32_t indexOf(const T* object) const
+    {
+        for (size_t blockIdx = 0; blockIdx < m_blocks.size(); ++blockIdx) {
+            const Slot* block = m_blocks[blockIdx];
+            const Slot* slot = reinterpret_cast<const Slot*>(object);
+
+            if (slot >= block && slot < block + BlockSize) {
+                return static_cast<uint32_t>(blockIdx * BlockSize + (slot - block));
+            }
+        }
+
+        //! NOTE the pointer didn't come from this pool, that's a caller bug
+        std::abort();
+    }
+
+    void addBlock()
+    {
+        Slot* block = new Slot[BlockSize];
+        uint32_t base = static_cast<uint32_t>(m_blocks.size() * BlockSize);
+
+        m_blocks.push_back(block);
+        m_used.resize(m_used.size() + BlockSize, false);
+
+        for (size_t i = 0; i < BlockSize; ++i) {
+            nextFreeIndex(block + i) = i + 1 < BlockSize ? base + static_cast<uint32_t>(i) + 1 : m_freeHead;
+        }
+
+        m_freeHead = base;
+    }
+
+    std::vector<Slot*> m_blocks;
+    std::vector<bool> m_used;
+    uint32_t m_freeHead = NO_INDEX;
+};
+}
+
+#endif // MU_FRAMEWORK_FIXEDPOOLALLOCATOR_H
@@ -0,0 +1,322 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_FRAMEWORK_FLATHASHMAP_H
+#define MU_FRAMEWORK_FLATHASHMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace mu {
+//! NOTE Open-addressing hash map with linear probing, intended for hot lookup paths.
+//! Unlike std::unordered_map there is no node per entry: all slots live in a single
+//! contiguous block, so a successful lookup usually touches one or two cache lines
+//! and insertion does not allocate (until the table grows).
+//!
+//! Requirements: KeyT and ValT must be default-constructible and assignable
+//! (erased slots are reset to a default-constructed state).
+//! Unlike std::unordered_map, references and iterators are invalidated when
+//! the table grows; don't hold them across an insertion.
+template<typename KeyT, typename ValT, typename HashT = std::hash<KeyT> >
+class FlatHashMap
+{
+public:
+    using PairType = std::pair<KeyT, ValT>;
+
+private:
+    enum class SlotState : uint8_t {
+        Empty = 0,
+        Full,
+        Erased
+    };
+
+    template<typename MapT, typename PairT>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = PairT;
+        using difference_type = std::ptrdiff_t;
+        using pointer = PairT*;
+        using reference = PairT&;
+
+        Iterator(MapT* map, size_t index)
+            : m_map(map), m_index(index) {}
+
+        //! NOTE iterator is implicitly convertible to const_iterator
+        operator Iterator<const MapT, const PairT>() const
+        {
+            return Iterator<const MapT, const PairT>(m_map, m_index);
+        }
+
+        PairT& operator*() const { return m_map->m_slots[m_index]; }
+        PairT* operator->() const { return &m_map->m_slots[m_index]; }
+
+        Iterator& operator++()
+        {
+            m_index = m_map->nextFullIndex(m_index + 1);
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        template<typename MapT2, typename PairT2>
+        bool operator==(const Iterator<MapT2, PairT2>& other) const { return m_index == other.index(); }
+        template<typename MapT2, typename PairT2>
+        bool operator!=(const Iterator<MapT2, PairT2>& other) const { return m_index != other.index(); }
+
+        size_t index() const { return m_index; }
+
+    private:
+        MapT* m_map = nullptr;
+        size_t m_index = 0;
+    };
+
+public:
+    using iterator = Iterator<FlatHashMap, PairType>;
+    using const_iterator = Iterator<const FlatHashMap, const PairType>;
+
+    FlatHashMap() = default;
+
+    iterator begin() { return iterator(this, nextFullIndex(0)); }
+    iterator end() { return iterator(this, capacity()); }
+    const_iterator begin() const { return const_iterator(this, nextFullIndex(0)); }
+    const_iterator end() const { return const_iterator(this, capacity()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+
+    void reserve(size_t expectedSize)
+    {
+        size_t needed = minCapacityForSize(expectedSize);
+        if (needed > capacity()) {
+            rehash(needed);
+        }
+    }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_states.clear();
+        m_size = 0;
+        m_occupied = 0;
+    }
+
+    iterator find(const KeyT& key)
+    {
+        return iterator(this, findIndex(key));
+    }
+
+    const_iterator find(const KeyT& key) const
+    {
+        return const_iterator(this, findIndex(key));
+    }
+
+    size_t count(const KeyT& key) const
+    {
+        return findIndex(key) != capacity() ? 1 : 0;
+    }
+
+    bool contains(const KeyT& key) const
+    {
+        return findIndex(key) != capacity();
+    }
+
+    ValT& operator[](const KeyT& key)
+    {
+        return tryEmplace(key).first->second;
+    }
+
+    std::pair<iterator, bool> insert(const PairType& pair)
+    {
+        std::pair<iterator, bool> result = tryEmplace(pair.first);
+        if (result.second) {
+            result.first->second = pair.second;
+        }
+        return result;
+    }
+
+    std::pair<iterator, bool> insert(PairType&& pair)
+    {
+        std::pair<iterator, bool> result = tryEmplace(pair.first);
+        if (result.second) {
+            result.first->second = std::move(pair.second);
+        }
+        return result;
+    }
+
+    //! NOTE the erased slot is only marked as such, so other iterators stay valid
+    iterator erase(const_iterator it)
+    {
+        size_t index = it.index();
+        eraseIndex(index);
+        return iterator(this, nextFullIndex(index + 1));
+    }
+
+    size_t erase(const KeyT& key)
+    {
+        size_t index = findIndex(key);
+        if (index == capacity()) {
+            return 0;
+        }
+
+        eraseIndex(index);
+        return 1;
+    }
+
+private:
+    friend iterator;
+    friend const_iterator;
+
+    static constexpr size_t MIN_CAPACITY = 8;
+
+    size_t capacity() const { return m_states.size(); }
+
+    static size_t minCapacityForSize(size_t size)
+    {
+        //! NOTE keep the load factor below 0.75
+        size_t result = MIN_CAPACITY;
+        while (size * 4 >= result * 3) {
+            result <<= 1;
+        }
+
+        return result;
+    }
+
+    size_t nextFullIndex(size_t index) const
+    {
+        while (index < capacity() && m_states[index] != SlotState::Full) {
+            ++index;
+        }
+
+        return index;
+    }
+
+    size_t findIndex(const KeyT& key) const
+    {
+        if (m_size == 0) {
+            return capacity();
+        }
+
+        size_t mask = capacity() - 1;
+        size_t index = HashT {}(key) & mask;
+
+        while (m_states[index] != SlotState::Empty) {
+            if (m_states[index] == SlotState::Full && m_slots[index].first == key) {
+                return index;
+            }
+
+            index = (index + 1) & mask;
+        }
+
+        return capacity();
+    }
+
+    std::pair<iterator, bool> tryEmplace(const KeyT& key)
+    {
+        if (m_occupied + 1 >= capacity() - (capacity() >> 2)) {
+            rehash(minCapacityForSize(m_size + 1));
+        }
+
+        size_t mask = capacity() - 1;
+        size_t index = HashT {}(key) & mask;
+        size_t insertIndex = capacity();
+
+        while (m_states[index] != SlotState::Empty) {
+            if (m_states[index] == SlotState::Full && m_slots[index].first == key) {
+                return { iterator(this, index), false };
+            }
+
+            if (m_states[index] == SlotState::Erased && insertIndex == capacity()) {
+                insertIndex = index;
+            }
+
+            index = (index + 1) & mask;
+        }
+
+        if (insertIndex == capacity()) {
+            insertIndex = index;
+            ++m_occupied;
+        }
+
+        m_states[insertIndex] = SlotState::Full;
+        m_slots[insertIndex].first = key;
+        ++m_size;
+
+        return { iterator(this, insertIndex), true };
+    }
+
+    void eraseIndex(size_t index)
+    {
+        m_states[index] = SlotState::Erased;
+        m_slots[index] = PairType();
+        --m_size;
+    }
+
+    void rehash(size_t newCapacity)
+    {
+        std::vector<PairType> oldSlots = std::move(m_slots);
+        std::vector<SlotState> oldStates = std::move(m_states);
+
+        m_slots = std::vector<PairType>(newCapacity);
+        m_states = std::vector<SlotState>(newCapacity, SlotState::Empty);
+        m_size = 0;
+        m_occupied = 0;
+
+        size_t mask = newCapacity - 1;
+
+        for (size_t i = 0; i < oldStates.size(); ++i) {
+            if (oldStates[i] != SlotState::Full) {
+                continue;
+            }
+
+            size_t index = HashT {}(oldSlots[i].first) & mask;
+            while (m_states[index] == SlotState::Full) {
+                index = (index + 1) & mask;
+            }
+
+            m_states[index] = SlotState::Full;
+            m_slots[index] = std::move(oldSlots[i]);
+            ++m_size;
+            ++m_occupied;
+        }
+    }
+
+    std::vector<PairType> m_slots;
+    std::vector<SlotState> m_states;
+    size_t m_size = 0;
+    size_t m_occupied = 0;
+};
+}
+
+#endif // MU_FRAMEWORK_FLATHASHMAP_H
@@ -0,0 +1,123 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "fixedpoolallocator.h"
+
+using namespace mu;
+
+class FixedPoolAllocatorTests : public ::testing::Test
+{
+public:
+    struct Counted {
+        static int aliveCount;
+
+        std::string payload;
+
+        Counted(const std::string& p = std::string())
+            : payload(p) { ++aliveCount; }
+        ~Counted() { --aliveCount; }
+    };
+};
+
+int FixedPoolAllocatorTests::Counted::aliveCount = 0;
+
+TEST_F(FixedPoolAllocatorTests, Alloc_Free)
+{
+    //! GIVEN Empty pool
+
+    FixedPoolAllocator<Counted, 4> pool;
+
+    //! WHEN Allocate more objects than one block holds
+
+    std::vector<Counted*> objects;
+    for (int i = 0; i < 10; ++i) {
+        objects.push_back(pool.alloc(std::to_string(i)));
+    }
+
+    //! THEN All objects are alive, distinct and keep their values
+
+    EXPECT_EQ(Counted::aliveCount, 10);
+    EXPECT_EQ(std::set<Counted*>(objects.cbegin(), objects.cend()).size(), 10);
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(objects[i]->payload, std::to_string(i));
+    }
+
+    //! WHEN Free them again
+
+    for (Counted* object : objects) {
+        pool.free(object);
+    }
+
+    //! THEN Every destructor has run
+
+    EXPECT_EQ(Counted::aliveCount, 0);
+}
+
+TEST_F(FixedPoolAllocatorTests, Slot_Reuse)
+{
+    //! GIVEN Pool with a freed slot
+
+    FixedPoolAllocator<Counted, 4> pool;
+
+    Counted* first = pool.alloc(std::string("first"));
+    Counted* second = pool.alloc(std::string("second"));
+    pool.free(first);
+
+    //! WHEN Allocate again
+
+    Counted* third = pool.alloc(std::string("third"));
+
+    //! THEN The freed slot is reused, other objects are untouched
+
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(third->payload, "third");
+    EXPECT_EQ(second->payload, "second");
+
+    pool.free(second);
+    pool.free(third);
+}
+
+TEST_F(FixedPoolAllocatorTests, Destroys_Remaining_Objects)
+{
+    //! GIVEN Pool with live objects
+
+    {
+        FixedPoolAllocator<Counted, 4> pool;
+        pool.alloc();
+        pool.alloc();
+        pool.alloc();
+
+        EXPECT_EQ(Counted::aliveCount, 3);
+
+        //! WHEN The pool goes out of scope
+    }
+
+    //! THEN The remaining objects have been destroyed with it
+
+    EXPECT_EQ(Counted::aliveCount, 0);
+}
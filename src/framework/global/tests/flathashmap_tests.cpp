@@ -0,0 +1,216 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "flathashmap.h"
+
+using namespace mu;
+
+class FlatHashMapTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(FlatHashMapTests, Insert_Find)
+{
+    //! GIVEN Empty map
+
+    FlatHashMap<std::string, int> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find("first"), map.end());
+
+    //! WHEN Insert some entries
+
+    map.insert({ "first", 1 });
+    map.insert({ "second", 2 });
+
+    //! THEN Entries are findable, size matches
+
+    EXPECT_EQ(map.size(), 2);
+
+    auto it = map.find("first");
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, 1);
+
+    EXPECT_EQ(map.find("third"), map.end());
+    EXPECT_EQ(map.count("second"), 1);
+    EXPECT_EQ(map.count("third"), 0);
+}
+
+TEST_F(FlatHashMapTests, Insert_Duplicate)
+{
+    //! GIVEN Map with an entry
+
+    FlatHashMap<std::string, int> map;
+    map.insert({ "key", 1 });
+
+    //! WHEN Insert the same key again
+
+    auto result = map.insert({ "key", 42 });
+
+    //! THEN The original entry is kept, as for std::unordered_map
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.find("key")->second, 1);
+}
+
+TEST_F(FlatHashMapTests, SubscriptOperator)
+{
+    //! GIVEN Empty map
+
+    FlatHashMap<std::string, int> map;
+
+    //! WHEN Access a missing key
+
+    int& val = map["key"];
+
+    //! THEN A default-constructed value has been inserted
+
+    EXPECT_EQ(val, 0);
+    EXPECT_EQ(map.size(), 1);
+
+    //! WHEN Assign through the subscript
+
+    map["key"] = 42;
+
+    //! THEN The stored value is updated
+
+    EXPECT_EQ(map.find("key")->second, 42);
+}
+
+TEST_F(FlatHashMapTests, Erase)
+{
+    //! GIVEN Map with a few entries
+
+    FlatHashMap<std::string, int> map;
+    map.insert({ "first", 1 });
+    map.insert({ "second", 2 });
+    map.insert({ "third", 3 });
+
+    //! WHEN Erase by key and by iterator
+
+    EXPECT_EQ(map.erase("second"), 1);
+    EXPECT_EQ(map.erase("missing"), 0);
+
+    auto it = map.find("first");
+    ASSERT_NE(it, map.end());
+    map.erase(it);
+
+    //! THEN Only the remaining entry is findable
+
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.find("first"), map.end());
+    EXPECT_EQ(map.find("second"), map.end());
+    EXPECT_EQ(map.find("third")->second, 3);
+
+    //! WHEN Re-insert an erased key
+
+    map.insert({ "second", 22 });
+
+    //! THEN It is findable again
+
+    EXPECT_EQ(map.find("second")->second, 22);
+}
+
+TEST_F(FlatHashMapTests, Iteration_AfterGrowth)
+{
+    //! GIVEN Map populated beyond the initial capacity, forcing growth
+
+    constexpr int entryCount = 1000;
+
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < entryCount; ++i) {
+        map.insert({ i, i * 2 });
+    }
+
+    EXPECT_EQ(map.size(), entryCount);
+
+    //! WHEN Walk over all entries
+
+    int visited = 0;
+    long long sum = 0;
+    for (const auto& pair : map) {
+        ++visited;
+        sum += pair.second - pair.first * 2;
+    }
+
+    //! THEN Every entry is visited exactly once and keeps its value
+
+    EXPECT_EQ(visited, entryCount);
+    EXPECT_EQ(sum, 0);
+
+    for (int i = 0; i < entryCount; ++i) {
+        ASSERT_EQ(map.find(i)->second, i * 2);
+    }
+}
+
+TEST_F(FlatHashMapTests, Erase_WhileIterating)
+{
+    //! GIVEN Map with entries with odd and even keys
+
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i) {
+        map.insert({ i, i });
+    }
+
+    //! WHEN Erase the odd ones during iteration
+
+    for (auto it = map.cbegin(); it != map.cend();) {
+        if (it->first % 2 != 0) {
+            it = map.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    //! THEN Exactly the even ones remain
+
+    EXPECT_EQ(map.size(), 50);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(map.contains(i), i % 2 == 0);
+    }
+}
+
+TEST_F(FlatHashMapTests, Reserve)
+{
+    //! GIVEN Map with reserved capacity
+
+    FlatHashMap<int, int> map;
+    map.reserve(500);
+
+    //! WHEN Fill up to the reserved size
+
+    for (int i = 0; i < 500; ++i) {
+        map[i] = i;
+    }
+
+    //! THEN All entries are present
+
+    EXPECT_EQ(map.size(), 500);
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_EQ(map.find(i)->second, i);
+    }
+}
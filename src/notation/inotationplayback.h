@@ -49,6 +49,10 @@ public:
     virtual midi::tick_t secToPlayedtick(float sec) const = 0;
     virtual midi::tick_t secToTick(float sec) const = 0;
 
+    //! NOTE bumped whenever the tick <-> seconds mapping changes; lets the
+    //! callers know that previously converted values are stale
+    virtual uint64_t tempoMapRevision() const = 0;
+
     virtual RectF playbackCursorRectByTick(midi::tick_t tick) const = 0;
 
     virtual RetVal<midi::tick_t> playPositionTickByElement(const EngravingItem* element) const = 0;
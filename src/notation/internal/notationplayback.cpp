@@ -56,6 +56,8 @@ NotationPlayback::NotationPlayback(IGetScore* getScore,
     : m_getScore(getScore)
 {
     notationChanged.onNotify(this, [this]() {
+        //! NOTE any edit may have changed the time map
+        ++m_tempoMapRevision;
         updateLoopBoundaries();
     });
 }
@@ -74,11 +76,17 @@ void NotationPlayback::init(INotationUndoStackPtr undoStack)
     m_playbackModel.setPlayRepeats(configuration()->isPlayRepeatsEnabled());
     m_playbackModel.load(score(), undoStack->notationChangesRange());
 
+    score()->tempoChanged().onNotify(this, [this]() {
+        ++m_tempoMapRevision;
+    });
+
     configuration()->isPlayRepeatsChanged().onNotify(this, [this]() {
         bool expandRepeats = configuration()->isPlayRepeatsEnabled();
         if (expandRepeats != m_playbackModel.isPlayRepeatsEnabled()) {
             m_playbackModel.setPlayRepeats(expandRepeats);
             m_playbackModel.reload();
+            //! NOTE expanding/collapsing repeats changes the played time line
+            ++m_tempoMapRevision;
         }
     });
 
@@ -140,7 +148,16 @@ audio::msecs_t NotationPlayback::totalPlayTime() const
 
 float NotationPlayback::playedTickToSec(tick_t tick) const
 {
-    return score() ? score()->utick2utime(tick) : 0.0;
+    if (m_playedTickToSecCache.valid && m_playedTickToSecCache.revision == m_tempoMapRevision
+        && m_playedTickToSecCache.tick == tick) {
+        return m_playedTickToSecCache.sec;
+    }
+
+    float sec = score() ? score()->utick2utime(tick) : 0.0;
+
+    m_playedTickToSecCache = { m_tempoMapRevision, tick, sec, true };
+
+    return sec;
 }
 
 tick_t NotationPlayback::secToPlayedtick(float sec) const
@@ -158,9 +175,22 @@ tick_t NotationPlayback::secToTick(float sec) const
         return 0;
     }
 
+    if (m_secToTickCache.valid && m_secToTickCache.revision == m_tempoMapRevision
+        && m_secToTickCache.sec == sec) {
+        return m_secToTickCache.tick;
+    }
+
     tick_t utick = secToPlayedtick(sec);
+    tick_t tick = score()->repeatList().utick2tick(utick);
+
+    m_secToTickCache = { m_tempoMapRevision, sec, tick, true };
 
-    return score()->repeatList().utick2tick(utick);
+    return tick;
+}
+
+uint64_t NotationPlayback::tempoMapRevision() const
+{
+    return m_tempoMapRevision;
 }
 
 //! NOTE Copied from ScoreView::moveCursor(const Fraction& tick)
@@ -59,6 +59,8 @@ public:
     midi::tick_t secToPlayedtick(float sec) const override;
     midi::tick_t secToTick(float sec) const override;
 
+    uint64_t tempoMapRevision() const override;
+
     RectF playbackCursorRectByTick(midi::tick_t tick) const override;
 
     RetVal<midi::tick_t> playPositionTickByElement(const EngravingItem* element) const override;
@@ -81,10 +83,31 @@ private:
 
     const Ms::TempoText* tempoText(int tick) const;
 
+    //! NOTE ticks are converted to seconds (and back) on every playback position
+    //! callback, usually for the same value several times in a row, so the last
+    //! conversion is memoized until the time map changes
+    struct TickToSecCache {
+        uint64_t revision = 0;
+        midi::tick_t tick = 0;
+        float sec = 0.f;
+        bool valid = false;
+    };
+
+    struct SecToTickCache {
+        uint64_t revision = 0;
+        float sec = 0.f;
+        midi::tick_t tick = 0;
+        bool valid = false;
+    };
+
     IGetScore* m_getScore = nullptr;
     async::Channel<int> m_playPositionTickChanged;
     ValCh<LoopBoundaries> m_loopBoundaries;
 
+    uint64_t m_tempoMapRevision = 0;
+    mutable TickToSecCache m_playedTickToSecCache;
+    mutable SecToTickCache m_secToTickCache;
+
     mutable engraving::PlaybackModel m_playbackModel;
 };
 }
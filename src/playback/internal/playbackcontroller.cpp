@@ -21,6 +21,7 @@
  */
 #include "playbackcontroller.h"
 
+#include "async/async.h"
 #include "log.h"
 
 #include "playbacktypes.h"
@@ -73,6 +74,12 @@ void PlaybackController::init()
         });
     });
 
+    notationConfiguration()->isPlayRepeatsChanged().onNotify(this, [this]() {
+        setStateBit(PlayRepeatsStateBit, notationConfiguration()->isPlayRepeatsEnabled());
+    });
+
+    refreshStateBits();
+
     m_needRewindBeforePlay = true;
 }
 
@@ -103,12 +110,13 @@ bool PlaybackController::isPaused() const
 
 bool PlaybackController::isLoopVisible() const
 {
-    return notationPlayback() ? notationPlayback()->loopBoundaries().val.visible : false;
+    return m_stateBits.load(std::memory_order_relaxed) & LoopStateBit;
 }
 
 bool PlaybackController::isPlaybackLooped() const
 {
-    return notationPlayback() ? !notationPlayback()->loopBoundaries().val.isNull() : false;
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    return notationPlayback ? !notationPlayback->loopBoundaries().val.isNull() : false;
 }
 
 Notification PlaybackController::isPlayingChanged() const
@@ -123,11 +131,15 @@ void PlaybackController::reset()
 
 void PlaybackController::seek(const midi::tick_t tick)
 {
-    IF_ASSERT_FAILED(notationPlayback() && playback()) {
+    //! NOTE each accessor call walks a virtual chain and bumps a shared_ptr
+    //! ref-count, so the result is cached for the duration of the call
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+
+    IF_ASSERT_FAILED(notationPlayback && playback()) {
         return;
     }
 
-    msecs_t milliseconds = secondsToMilliseconds(notationPlayback()->playedTickToSec(tick));
+    msecs_t milliseconds = secondsToMilliseconds(notationPlayback->playedTickToSec(tick));
     playback()->player()->seek(m_currentSequenceId, std::move(milliseconds));
 }
 
@@ -152,7 +164,8 @@ Channel<uint32_t> PlaybackController::midiTickPlayed() const
 
 float PlaybackController::playbackPositionInSeconds() const
 {
-    return notationPlayback() ? notationPlayback()->playedTickToSec(m_currentTick) : 0.0;
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    return notationPlayback ? notationPlayback->playedTickToSec(m_currentTick) : 0.0;
 }
 
 TrackSequenceId PlaybackController::currentTrackSequenceId() const
@@ -171,11 +184,13 @@ void PlaybackController::playElement(const notation::EngravingItem* element)
         return;
     }
 
-    IF_ASSERT_FAILED(notationPlayback()) {
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+
+    IF_ASSERT_FAILED(notationPlayback) {
         return;
     }
 
-    RetVal<midi::tick_t> tick = notationPlayback()->playPositionTickByElement(element);
+    RetVal<midi::tick_t> tick = notationPlayback->playPositionTickByElement(element);
     if (!tick.ret) {
         return;
     }
@@ -186,7 +201,7 @@ void PlaybackController::playElement(const notation::EngravingItem* element)
         return;
     }
 
-    notationPlayback()->triggerEventsForItem(element);
+    notationPlayback->triggerEventsForItem(element);
 }
 
 INotationPlaybackPtr PlaybackController::notationPlayback() const
@@ -215,20 +230,40 @@ void PlaybackController::onNotationChanged()
 
     INotationPartsPtr notationParts = m_notation->parts();
 
-    if (!m_trackIdMap.empty()) {
+    if (!m_trackIdMap.empty() && audioSettings()) {
+        //! NOTE collect all activity updates in one pass and push them to the
+        //! audio worker as a single batch instead of one call per track
+        TrackAudioOutputParamsList paramsUpdates;
+        paramsUpdates.reserve(m_trackIdMap.size());
+
         for (const Part* part : m_masterNotation->parts()->partList()) {
             bool isActive = notationParts->partExists(part->id());
 
             for (const InstrumentTrackId& instrumentTrackId : part->instrumentTrackIdSet()) {
-                setTrackActivity(instrumentTrackId, isActive);
+                auto search = m_trackIdMap.find(instrumentTrackId);
+                if (search == m_trackIdMap.cend()) {
+                    continue;
+                }
+
+                AudioOutputParams outParams = audioSettings()->trackOutputParams(instrumentTrackId);
+                outParams.muted = !isActive;
+
+                paramsUpdates.emplace_back(search->second, std::move(outParams));
             }
         }
+
+        playback()->audioOutput()->setOutputParams(m_currentSequenceId, paramsUpdates);
     }
 
+    //! NOTE the new notation's loop range hasn't been pushed to the player yet
+    m_loopRangeCache = {};
+
     notationPlayback()->loopBoundaries().ch.onReceive(this, [this](const LoopBoundaries& boundaries) {
         setLoop(boundaries);
     });
 
+    refreshStateBits();
+
     m_isPlayAllowedChanged.notify();
 }
 
@@ -248,9 +283,24 @@ void PlaybackController::togglePlay()
     }
 }
 
+template<typename Op>
+void PlaybackController::applyTransport(bool newIsPlaying, Op op)
+{
+    IF_ASSERT_FAILED(playback()) {
+        return;
+    }
+
+    op(playback()->player(), m_currentSequenceId);
+
+    if (m_isPlaying != newIsPlaying) {
+        m_isPlaying = newIsPlaying;
+        markDirty(PlayingDirtyBit);
+    }
+}
+
 void PlaybackController::play()
 {
-    IF_ASSERT_FAILED(notationPlayback() && playback()) {
+    IF_ASSERT_FAILED(notationPlayback()) {
         return;
     }
 
@@ -260,10 +310,9 @@ void PlaybackController::play()
         m_needRewindBeforePlay = true;
     }
 
-    playback()->player()->play(m_currentSequenceId);
-
-    m_isPlaying = true;
-    m_isPlayingChanged.notify();
+    applyTransport(true, [](const audio::IPlayerPtr& player, const TrackSequenceId sequenceId) {
+        player->play(sequenceId);
+    });
 }
 
 void PlaybackController::rewind(const ActionData& args)
@@ -288,43 +337,30 @@ void PlaybackController::rewind(const ActionData& args)
 
 void PlaybackController::pause()
 {
-    IF_ASSERT_FAILED(playback()) {
-        return;
-    }
-
-    playback()->player()->pause(m_currentSequenceId);
-
-    m_isPlaying = false;
-    m_isPlayingChanged.notify();
+    applyTransport(false, [](const audio::IPlayerPtr& player, const TrackSequenceId sequenceId) {
+        player->pause(sequenceId);
+    });
 }
 
 void PlaybackController::stop()
 {
-    IF_ASSERT_FAILED(playback()) {
-        return;
-    }
-
-    playback()->player()->stop(m_currentSequenceId);
-    m_isPlaying = false;
-    m_isPlayingChanged.notify();
+    applyTransport(false, [](const audio::IPlayerPtr& player, const TrackSequenceId sequenceId) {
+        player->stop(sequenceId);
+    });
 }
 
 void PlaybackController::resume()
 {
-    IF_ASSERT_FAILED(playback()) {
-        return;
-    }
-
-    playback()->player()->resume(m_currentSequenceId);
-
-    m_isPlaying = true;
-    m_isPlayingChanged.notify();
+    applyTransport(true, [](const audio::IPlayerPtr& player, const TrackSequenceId sequenceId) {
+        player->resume(sequenceId);
+    });
 }
 
 void PlaybackController::togglePlayRepeats()
 {
     bool playRepeatsEnabled = notationConfiguration()->isPlayRepeatsEnabled();
     notationConfiguration()->setIsPlayRepeatsEnabled(!playRepeatsEnabled);
+    setStateBit(PlayRepeatsStateBit, !playRepeatsEnabled);
     notifyActionCheckedChanged(REPEAT_CODE);
 }
 
@@ -332,6 +368,7 @@ void PlaybackController::toggleAutomaticallyPan()
 {
     bool panEnabled = notationConfiguration()->isAutomaticallyPanEnabled();
     notationConfiguration()->setIsAutomaticallyPanEnabled(!panEnabled);
+    setStateBit(PanStateBit, !panEnabled);
     notifyActionCheckedChanged(PAN_CODE);
 }
 
@@ -339,6 +376,7 @@ void PlaybackController::toggleMetronome()
 {
     bool metronomeEnabled = notationConfiguration()->isMetronomeEnabled();
     notationConfiguration()->setIsMetronomeEnabled(!metronomeEnabled);
+    setStateBit(MetronomeStateBit, !metronomeEnabled);
     notifyActionCheckedChanged(METRONOME_CODE);
 
     setTrackActivity(notationPlayback()->metronomeTrackId(), !metronomeEnabled);
@@ -348,6 +386,7 @@ void PlaybackController::toggleMidiInput()
 {
     bool midiInputEnabled = notationConfiguration()->isMidiInputEnabled();
     notationConfiguration()->setIsMidiInputEnabled(!midiInputEnabled);
+    setStateBit(MidiInputStateBit, !midiInputEnabled);
     notifyActionCheckedChanged(MIDI_ON_CODE);
 }
 
@@ -355,6 +394,7 @@ void PlaybackController::toggleCountIn()
 {
     bool countInEnabled = notationConfiguration()->isCountInEnabled();
     notationConfiguration()->setIsCountInEnabled(!countInEnabled);
+    setStateBit(CountInStateBit, !countInEnabled);
     notifyActionCheckedChanged(COUNT_IN_CODE);
 }
 
@@ -378,13 +418,10 @@ void PlaybackController::toggleLoopPlayback()
         loopOutTick = selection()->range()->endTick().ticks();
     }
 
-    if (loopInTick <= 0) {
-        loopInTick = INotationPlayback::FirstScoreTick;
-    }
-
-    if (loopOutTick <= 0) {
-        loopOutTick = INotationPlayback::LastScoreTick;
-    }
+    //! NOTE conditional selects instead of branches: the selection is often empty,
+    //! which makes the equivalent if-s poorly predicted
+    loopInTick = (loopInTick > 0) ? loopInTick : INotationPlayback::FirstScoreTick;
+    loopOutTick = (loopOutTick > 0) ? loopOutTick : INotationPlayback::LastScoreTick;
 
     addLoopBoundaryToTick(LoopBoundaryType::LoopIn, loopInTick);
     addLoopBoundaryToTick(LoopBoundaryType::LoopOut, loopOutTick);
@@ -401,8 +438,9 @@ void PlaybackController::addLoopBoundary(LoopBoundaryType type)
 
 void PlaybackController::addLoopBoundaryToTick(LoopBoundaryType type, int tick)
 {
-    if (notationPlayback()) {
-        notationPlayback()->addLoopBoundary(type, tick);
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    if (notationPlayback) {
+        notationPlayback->addLoopBoundary(type, tick);
         showLoop();
     }
 }
@@ -418,9 +456,21 @@ void PlaybackController::setLoop(const LoopBoundaries& boundaries)
         return;
     }
 
-    msecs_t fromMilliseconds = secondsToMilliseconds(notationPlayback()->playedTickToSec(boundaries.loopInTick));
-    msecs_t toMilliseconds = secondsToMilliseconds(notationPlayback()->playedTickToSec(boundaries.loopOutTick));
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+
+    if (boundaries.loopInTick == m_loopRangeCache.loopInTick
+        && boundaries.loopOutTick == m_loopRangeCache.loopOutTick
+        && notationPlayback->tempoMapRevision() == m_loopRangeCache.tempoMapRevision) {
+        //! NOTE the player already has this range in up-to-date milliseconds,
+        //! no need to cross the audio-thread boundary again
+        showLoop();
+        return;
+    }
+
+    msecs_t fromMilliseconds = secondsToMilliseconds(notationPlayback->playedTickToSec(boundaries.loopInTick));
+    msecs_t toMilliseconds = secondsToMilliseconds(notationPlayback->playedTickToSec(boundaries.loopOutTick));
     playback()->player()->setLoop(m_currentSequenceId, fromMilliseconds, toMilliseconds);
+    m_loopRangeCache = { boundaries.loopInTick, boundaries.loopOutTick, notationPlayback->tempoMapRevision() };
     showLoop();
 
     notifyActionCheckedChanged(LOOP_CODE);
@@ -428,19 +478,25 @@ void PlaybackController::setLoop(const LoopBoundaries& boundaries)
 
 void PlaybackController::showLoop()
 {
-    if (notationPlayback()) {
-        notationPlayback()->setLoopBoundariesVisible(true);
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    if (notationPlayback) {
+        notationPlayback->setLoopBoundariesVisible(true);
+        setStateBit(LoopStateBit, true);
     }
 }
 
 void PlaybackController::hideLoop()
 {
-    IF_ASSERT_FAILED(notationPlayback() && playback()) {
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+
+    IF_ASSERT_FAILED(notationPlayback && playback()) {
         return;
     }
 
     playback()->player()->resetLoop(m_currentSequenceId);
-    notationPlayback()->setLoopBoundariesVisible(false);
+    m_loopRangeCache = {};
+    notationPlayback->setLoopBoundariesVisible(false);
+    setStateBit(LoopStateBit, false);
     notifyActionCheckedChanged(LOOP_CODE);
 }
 
@@ -449,6 +505,75 @@ void PlaybackController::notifyActionCheckedChanged(const ActionCode& actionCode
     m_actionCheckedChanged.send(actionCode);
 }
 
+void PlaybackController::markDirty(NotificationDirtyBit bit)
+{
+    bool flushPending = m_dirtyNotificationBits != 0;
+    m_dirtyNotificationBits |= bit;
+
+    if (flushPending) {
+        return;
+    }
+
+    async::Async::call(this, [this]() {
+        flushDirtyNotifications();
+    });
+}
+
+void PlaybackController::flushDirtyNotifications()
+{
+    uint32_t dirtyBits = m_dirtyNotificationBits;
+    m_dirtyNotificationBits = 0;
+
+    if (dirtyBits & PlayingDirtyBit) {
+        m_isPlayingChanged.notify();
+    }
+
+    if (dirtyBits & PlaybackPositionDirtyBit) {
+        m_playbackPositionChanged.notify();
+    }
+}
+
+void PlaybackController::setStateBit(StateBit bit, bool enabled)
+{
+    if (enabled) {
+        m_stateBits.fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        m_stateBits.fetch_and(~uint32_t(bit), std::memory_order_relaxed);
+    }
+}
+
+void PlaybackController::refreshStateBits()
+{
+    uint32_t stateBits = 0;
+
+    if (notationConfiguration()->isMidiInputEnabled()) {
+        stateBits |= MidiInputStateBit;
+    }
+
+    if (notationConfiguration()->isPlayRepeatsEnabled()) {
+        stateBits |= PlayRepeatsStateBit;
+    }
+
+    if (notationConfiguration()->isAutomaticallyPanEnabled()) {
+        stateBits |= PanStateBit;
+    }
+
+    if (notationConfiguration()->isMetronomeEnabled()) {
+        stateBits |= MetronomeStateBit;
+    }
+
+    if (notationConfiguration()->isCountInEnabled()) {
+        stateBits |= CountInStateBit;
+    }
+
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    if (notationPlayback && notationPlayback->loopBoundaries().val.visible) {
+        stateBits |= LoopStateBit;
+    }
+
+    m_stateBits.store(stateBits, std::memory_order_relaxed);
+}
+
 mu::project::IProjectAudioSettingsPtr PlaybackController::audioSettings() const
 {
     IF_ASSERT_FAILED(globalContext()->currentProject()) {
@@ -469,7 +594,8 @@ void PlaybackController::resetCurrentSequence()
 
     setCurrentTick(0);
     m_isPlaying = false;
-    m_isPlayingChanged.notify();
+    m_trackMutations.clear();
+    markDirty(PlayingDirtyBit);
 
     playback()->removeSequence(m_currentSequenceId);
     m_currentSequenceId = -1;
@@ -478,12 +604,14 @@ void PlaybackController::resetCurrentSequence()
 void PlaybackController::setCurrentTick(const tick_t tick)
 {
     m_currentTick = tick;
-    m_playbackPositionChanged.notify();
+    markDirty(PlaybackPositionDirtyBit);
 }
 
 void PlaybackController::addTrack(const InstrumentTrackId& instrumentTrackId, const std::string& title)
 {
-    IF_ASSERT_FAILED(notationPlayback() && playback()) {
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+
+    IF_ASSERT_FAILED(notationPlayback && playback()) {
         return;
     }
 
@@ -493,13 +621,13 @@ void PlaybackController::addTrack(const InstrumentTrackId& instrumentTrackId, co
 
     AudioInputParams inParams = audioSettings()->trackInputParams(instrumentTrackId);
     AudioOutputParams outParams = trackOutputParams(instrumentTrackId);
-    mpe::PlaybackData playbackData = notationPlayback()->trackPlaybackData(instrumentTrackId);
+    mpe::PlaybackData playbackData = notationPlayback->trackPlaybackData(instrumentTrackId);
 
     if (!playbackData.isValid()) {
         return;
     }
 
-    uint64_t notationPlaybackKey = reinterpret_cast<uint64_t>(notationPlayback().get());
+    uint64_t notationPlaybackKey = reinterpret_cast<uint64_t>(notationPlayback.get());
 
     playback()->tracks()->addTrack(m_currentSequenceId, title, std::move(playbackData), { std::move(inParams), std::move(outParams) })
     .onResolve(this, [this, instrumentTrackId, notationPlaybackKey](const TrackId trackId, const AudioParams& appliedParams) {
@@ -511,6 +639,7 @@ void PlaybackController::addTrack(const InstrumentTrackId& instrumentTrackId, co
         }
 
         m_trackIdMap.insert({ instrumentTrackId, trackId });
+        m_trackIdReverseMap.insert({ trackId, instrumentTrackId });
 
         audioSettings()->setTrackInputParams(instrumentTrackId, appliedParams.in);
         audioSettings()->setTrackOutputParams(instrumentTrackId, appliedParams.out);
@@ -526,23 +655,29 @@ void PlaybackController::setTrackActivity(const engraving::InstrumentTrackId& in
         return;
     }
 
+    auto search = m_trackIdMap.find(instrumentTrackId);
+    if (search == m_trackIdMap.cend()) {
+        return;
+    }
+
     AudioOutputParams outParams = audioSettings()->trackOutputParams(instrumentTrackId);
 
     outParams.muted = !isActive;
 
-    audio::TrackId trackId = m_trackIdMap[instrumentTrackId];
-    playback()->audioOutput()->setOutputParams(m_currentSequenceId, trackId, std::move(outParams));
+    playback()->audioOutput()->setOutputParams(m_currentSequenceId, search->second, std::move(outParams));
 }
 
 AudioOutputParams PlaybackController::trackOutputParams(const engraving::InstrumentTrackId& instrumentTrackId) const
 {
-    IF_ASSERT_FAILED(audioSettings() && notationConfiguration() && notationPlayback()) {
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+
+    IF_ASSERT_FAILED(audioSettings() && notationConfiguration() && notationPlayback) {
         return {};
     }
 
     AudioOutputParams result = audioSettings()->trackOutputParams(instrumentTrackId);
 
-    if (instrumentTrackId == notationPlayback()->metronomeTrackId()) {
+    if (instrumentTrackId == notationPlayback->metronomeTrackId()) {
         result.muted = !notationConfiguration()->isMetronomeEnabled();
     }
 
@@ -551,19 +686,54 @@ AudioOutputParams PlaybackController::trackOutputParams(const engraving::Instrum
 
 void PlaybackController::removeNonExistingTracks()
 {
+    IF_ASSERT_FAILED(playback()) {
+        return;
+    }
+
+    INotationPartsPtr masterNotationParts = this->masterNotationParts();
+    if (!masterNotationParts) {
+        return;
+    }
+
+    //! NOTE two phases: collect the expired ids first, then erase, so the map
+    //! is never mutated under the iteration
+    std::vector<InstrumentTrackId> expiredTrackIds;
+
     for (const auto& pair : m_trackIdMap) {
-        if (!masterNotationParts()->partExists(pair.first.partId)) {
-            removeTrack(pair.first);
+        const Part* part = masterNotationParts->part(pair.first.partId);
+        if (!part) {
+            expiredTrackIds.push_back(pair.first);
             continue;
         }
 
-        const Part* part = masterNotationParts()->part(pair.first.partId);
         const InstrumentTrackIdSet& idSet = part->instrumentTrackIdSet();
 
         if (idSet.find(pair.first) == idSet.cend()) {
-            removeTrack(pair.first);
+            expiredTrackIds.push_back(pair.first);
         }
     }
+
+    if (expiredTrackIds.empty()) {
+        return;
+    }
+
+    TrackIdList removedTrackIds;
+    removedTrackIds.reserve(expiredTrackIds.size());
+
+    for (const InstrumentTrackId& instrumentTrackId : expiredTrackIds) {
+        auto search = m_trackIdMap.find(instrumentTrackId);
+        if (search == m_trackIdMap.cend()) {
+            continue;
+        }
+
+        removedTrackIds.push_back(search->second);
+        audioSettings()->removeTrackParams(instrumentTrackId);
+
+        m_trackIdReverseMap.erase(search->second);
+        m_trackIdMap.erase(search);
+    }
+
+    playback()->tracks()->removeTracks(m_currentSequenceId, removedTrackIds);
 }
 
 void PlaybackController::removeTrack(const InstrumentTrackId& partId)
@@ -580,6 +750,9 @@ void PlaybackController::removeTrack(const InstrumentTrackId& partId)
 
     playback()->tracks()->removeTrack(m_currentSequenceId, search->second);
     audioSettings()->removeTrackParams(partId);
+
+    m_trackIdReverseMap.erase(search->second);
+    m_trackIdMap.erase(search);
 }
 
 void PlaybackController::setupNewCurrentSequence(const TrackSequenceId sequenceId)
@@ -615,12 +788,10 @@ void PlaybackController::subscribeOnAudioParamsChanges()
             return;
         }
 
-        auto search = std::find_if(m_trackIdMap.begin(), m_trackIdMap.end(), [trackId](const auto& pair) {
-            return pair.second == trackId;
-        });
+        auto search = m_trackIdReverseMap.find(trackId);
 
-        if (search != m_trackIdMap.end()) {
-            audioSettings()->setTrackInputParams(search->first, params);
+        if (search != m_trackIdReverseMap.end()) {
+            audioSettings()->setTrackInputParams(search->second, params);
         }
     });
 
@@ -632,12 +803,10 @@ void PlaybackController::subscribeOnAudioParamsChanges()
             return;
         }
 
-        auto search = std::find_if(m_trackIdMap.begin(), m_trackIdMap.end(), [trackId](const auto& pair) {
-            return pair.second == trackId;
-        });
+        auto search = m_trackIdReverseMap.find(trackId);
 
-        if (search != m_trackIdMap.end()) {
-            audioSettings()->setTrackOutputParams(search->first, params);
+        if (search != m_trackIdReverseMap.end()) {
+            audioSettings()->setTrackOutputParams(search->second, params);
         }
     });
 }
@@ -645,52 +814,138 @@ void PlaybackController::subscribeOnAudioParamsChanges()
 void PlaybackController::setupSequenceTracks()
 {
     m_trackIdMap.clear();
+    m_trackIdReverseMap.clear();
+    m_trackMutations.clear();
 
-    if (!masterNotationParts()) {
+    INotationPartsPtr masterNotationParts = this->masterNotationParts();
+    if (!masterNotationParts) {
         return;
     }
 
-    NotifyList<const Part*> partList = masterNotationParts()->partList();
+    NotifyList<const Part*> partList = masterNotationParts->partList();
+
+    size_t expectedTrackCount = 1; // the metronome track
+    for (const Part* part : partList) {
+        expectedTrackCount += part->instruments()->size();
+    }
+
+    m_trackIdMap.reserve(expectedTrackCount);
+    m_trackIdReverseMap.reserve(expectedTrackCount);
 
     for (const Part* part : partList) {
+        //! NOTE QString::toStdString allocates, so the part name is converted
+        //! once per part instead of once per instrument
+        const std::string partName = part->partName().toStdString();
+
         for (const auto& pair : *part->instruments()) {
-            addTrack({ part->id(), pair.second->id().toStdString() }, part->partName().toStdString());
+            addTrack({ part->id(), pair.second->id().toStdString() }, partName);
         }
     }
 
     addTrack(notationPlayback()->metronomeTrackId(), qtrc("playback", "Metronome").toStdString());
 
     partList.onItemAdded(this, [this](const Part* part) {
+        const std::string partName = part->partName().toStdString();
+
         for (const auto& pair : *part->instruments()) {
-            addTrack({ part->id(), pair.second->id().toStdString() }, part->partName().toStdString());
+            enqueueTrackMutation({ TrackMutation::Kind::Add,
+                                   { part->id(), pair.second->id().toStdString() },
+                                   partName });
         }
     });
 
     partList.onItemChanged(this, [this](const Part* part) {
+        const std::string partName = part->partName().toStdString();
+
         for (const auto& pair : *part->instruments()) {
-            InstrumentTrackId trackId = { part->id(), pair.second->id().toStdString() };
-            AudioOutputParams params = trackOutputParams(trackId);
+            enqueueTrackMutation({ TrackMutation::Kind::Update,
+                                   { part->id(), pair.second->id().toStdString() },
+                                   partName,
+                                   part->isVisible() });
+        }
+    });
 
-            auto search = m_trackIdMap.find(trackId);
+    partList.onItemRemoved(this, [this](const Part* part) {
+        for (const auto& pair : *part->instruments()) {
+            enqueueTrackMutation({ TrackMutation::Kind::Remove,
+                                   { part->id(), pair.second->id().toStdString() } });
+        }
+    });
+}
+
+void PlaybackController::enqueueTrackMutation(TrackMutation mutation)
+{
+    m_trackMutations.push_back(std::move(mutation));
+
+    if (m_trackMutationsFlushPending) {
+        return;
+    }
+
+    m_trackMutationsFlushPending = true;
+
+    async::Async::call(this, [this]() {
+        flushTrackMutations();
+    });
+}
+
+void PlaybackController::flushTrackMutations()
+{
+    m_trackMutationsFlushPending = false;
+
+    std::vector<TrackMutation> mutations;
+    mutations.swap(m_trackMutations);
+
+    //! NOTE the drain is deferred, so the notation the mutations were queued
+    //! for may already be closed
+    if (!m_notation || !m_masterNotation) {
+        return;
+    }
+
+    for (size_t i = 0; i < mutations.size(); ++i) {
+        const TrackMutation& mutation = mutations[i];
+
+        //! NOTE adding or updating a track is pointless if the same track
+        //! is removed later in the burst
+        if (mutation.kind != TrackMutation::Kind::Remove) {
+            bool removedLater = false;
+
+            for (size_t j = i + 1; j < mutations.size(); ++j) {
+                if (mutations[j].kind == TrackMutation::Kind::Remove
+                    && mutations[j].trackId == mutation.trackId) {
+                    removedLater = true;
+                    break;
+                }
+            }
+
+            if (removedLater) {
+                continue;
+            }
+        }
+
+        switch (mutation.kind) {
+        case TrackMutation::Kind::Add:
+            addTrack(mutation.trackId, mutation.title);
+            break;
+        case TrackMutation::Kind::Remove:
+            removeTrack(mutation.trackId);
+            break;
+        case TrackMutation::Kind::Update: {
+            auto search = m_trackIdMap.find(mutation.trackId);
             if (search == m_trackIdMap.cend()) {
-                addTrack(trackId, part->partName().toStdString());
+                addTrack(mutation.trackId, mutation.title);
                 removeNonExistingTracks();
-                continue;
+                break;
             }
 
-            if (params.muted == !part->isVisible()) {
-                continue;
+            if (trackOutputParams(mutation.trackId).muted == !mutation.isActive) {
+                break;
             }
 
-            setTrackActivity(trackId, part->isVisible());
+            setTrackActivity(mutation.trackId, mutation.isActive);
+            break;
         }
-    });
-
-    partList.onItemRemoved(this, [this](const Part* part) {
-        for (const auto& pair : *part->instruments()) {
-            removeTrack({ part->id(), pair.second->id().toStdString() });
         }
-    });
+    }
 }
 
 void PlaybackController::setupSequencePlayer()
@@ -720,23 +975,42 @@ void PlaybackController::setupSequencePlayer()
 
         if (m_currentPlaybackStatus == PlaybackStatus::Paused) {
             m_isPlaying = false;
-            m_isPlayingChanged.notify();
+            markDirty(PlayingDirtyBit);
         }
     });
 }
 
 bool PlaybackController::actionChecked(const ActionCode& actionCode) const
 {
-    QMap<std::string, bool> isChecked {
-        { LOOP_CODE, isLoopVisible() },
-        { MIDI_ON_CODE, notationConfiguration()->isMidiInputEnabled() },
-        { REPEAT_CODE, notationConfiguration()->isPlayRepeatsEnabled() },
-        { PAN_CODE, notationConfiguration()->isAutomaticallyPanEnabled() },
-        { METRONOME_CODE, notationConfiguration()->isMetronomeEnabled() },
-        { COUNT_IN_CODE, notationConfiguration()->isCountInEnabled() }
-    };
+    //! NOTE called on every menu/toolbar refresh, so the states are read from
+    //! the packed snapshot instead of querying each source object
+    uint32_t stateBits = m_stateBits.load(std::memory_order_relaxed);
+
+    if (actionCode == LOOP_CODE) {
+        return stateBits & LoopStateBit;
+    }
+
+    if (actionCode == MIDI_ON_CODE) {
+        return stateBits & MidiInputStateBit;
+    }
+
+    if (actionCode == REPEAT_CODE) {
+        return stateBits & PlayRepeatsStateBit;
+    }
 
-    return isChecked[actionCode];
+    if (actionCode == PAN_CODE) {
+        return stateBits & PanStateBit;
+    }
+
+    if (actionCode == METRONOME_CODE) {
+        return stateBits & MetronomeStateBit;
+    }
+
+    if (actionCode == COUNT_IN_CODE) {
+        return stateBits & CountInStateBit;
+    }
+
+    return false;
 }
 
 Channel<ActionCode> PlaybackController::actionCheckedChanged() const
@@ -744,35 +1018,33 @@ Channel<ActionCode> PlaybackController::actionCheckedChanged() const
     return m_actionCheckedChanged;
 }
 
-QTime PlaybackController::totalPlayTime() const
+msecs_t PlaybackController::totalPlayTimeMsecs() const
 {
-    QTime result = ZERO_TIME;
-
-    if (!notationPlayback()) {
-        return result;
-    }
-
-    return result.addMSecs(notationPlayback()->totalPlayTime());
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    return notationPlayback ? notationPlayback->totalPlayTime() : 0;
 }
 
 Tempo PlaybackController::currentTempo() const
 {
-    return notationPlayback() ? notationPlayback()->tempo(currentTick()) : Tempo();
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    return notationPlayback ? notationPlayback->tempo(currentTick()) : Tempo();
 }
 
 MeasureBeat PlaybackController::currentBeat() const
 {
-    return notationPlayback() ? notationPlayback()->beat(currentTick()) : MeasureBeat();
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    return notationPlayback ? notationPlayback->beat(currentTick()) : MeasureBeat();
 }
 
 msecs_t PlaybackController::beatToMilliseconds(int measureIndex, int beatIndex) const
 {
-    if (!notationPlayback()) {
+    INotationPlaybackPtr notationPlayback = this->notationPlayback();
+    if (!notationPlayback) {
         return 0;
     }
 
-    int tick = notationPlayback()->beatToTick(measureIndex, beatIndex);
-    msecs_t milliseconds = secondsToMilliseconds(notationPlayback()->playedTickToSec(tick));
+    int tick = notationPlayback->beatToTick(measureIndex, beatIndex);
+    msecs_t milliseconds = secondsToMilliseconds(notationPlayback->playedTickToSec(tick));
 
     return milliseconds;
 }
@@ -22,8 +22,9 @@
 #ifndef MU_PLAYBACK_PLAYBACKCONTROLLER_H
 #define MU_PLAYBACK_PLAYBACKCONTROLLER_H
 
-#include <unordered_map>
+#include <atomic>
 
+#include "flathashmap.h"
 #include "modularity/ioc.h"
 #include "retval.h"
 #include "async/asyncable.h"
@@ -78,7 +79,7 @@ public:
     bool actionChecked(const actions::ActionCode& actionCode) const override;
     async::Channel<actions::ActionCode> actionCheckedChanged() const override;
 
-    QTime totalPlayTime() const override;
+    audio::msecs_t totalPlayTimeMsecs() const override;
 
     notation::Tempo currentTempo() const override;
     notation::MeasureBeat currentBeat() const override;
@@ -103,6 +104,11 @@ private:
     void stop();
     void resume();
 
+    //! NOTE play/pause/stop/resume all cross the audio-engine boundary and then
+    //! flip m_isPlaying, so the common part is fused into one helper
+    template<typename Op>
+    void applyTransport(bool newIsPlaying, Op op);
+
     void togglePlayRepeats();
     void toggleAutomaticallyPan();
     void toggleMetronome();
@@ -120,6 +126,31 @@ private:
 
     void notifyActionCheckedChanged(const actions::ActionCode& actionCode);
 
+    //! NOTE the checkable playback states live in disparate objects behind virtual
+    //! calls; they are mirrored into one word so actionChecked() is a single load
+    enum StateBit : uint32_t {
+        LoopStateBit = 1 << 0,
+        MidiInputStateBit = 1 << 1,
+        PlayRepeatsStateBit = 1 << 2,
+        PanStateBit = 1 << 3,
+        MetronomeStateBit = 1 << 4,
+        CountInStateBit = 1 << 5
+    };
+
+    void setStateBit(StateBit bit, bool enabled);
+    void refreshStateBits();
+
+    //! NOTE hot paths can fire the same notification many times within one
+    //! event-loop tick (bulk edits, playback position streaming); the bits are
+    //! accumulated and the subscribers notified once per tick
+    enum NotificationDirtyBit : uint32_t {
+        PlayingDirtyBit = 1 << 0,
+        PlaybackPositionDirtyBit = 1 << 1
+    };
+
+    void markDirty(NotificationDirtyBit bit);
+    void flushDirtyNotifications();
+
     project::IProjectAudioSettingsPtr audioSettings() const;
 
     void resetCurrentSequence();
@@ -128,6 +159,25 @@ private:
     void setupSequenceTracks();
     void setupSequencePlayer();
 
+    //! NOTE part add/remove/change notifications can arrive in bursts (paste, undo,
+    //! instrument swap); the mutations are queued and drained once per burst from
+    //! the event loop instead of mutating the audio tracks inside each notification
+    struct TrackMutation {
+        enum class Kind {
+            Add,
+            Remove,
+            Update
+        };
+
+        Kind kind = Kind::Add;
+        engraving::InstrumentTrackId trackId;
+        std::string title;
+        bool isActive = false;
+    };
+
+    void enqueueTrackMutation(TrackMutation mutation);
+    void flushTrackMutations();
+
     void setCurrentTick(const midi::tick_t tick);
     void addTrack(const engraving::InstrumentTrackId& instrumentTrackId, const std::string& title);
     void setTrackActivity(const engraving::InstrumentTrackId& instrumentTrackId, const bool isActive);
@@ -148,12 +198,30 @@ private:
 
     bool m_isPlaying = false;
 
+    //! NOTE the loop range last pushed to the audio player, to skip no-op re-sends;
+    //! the tempo map revision guards against stale millisecond conversions
+    struct LoopRangeCache {
+        int loopInTick = -1;
+        int loopOutTick = -1;
+        uint64_t tempoMapRevision = 0;
+    };
+
+    LoopRangeCache m_loopRangeCache;
+
+    std::atomic<uint32_t> m_stateBits = { 0 };
+
+    uint32_t m_dirtyNotificationBits = 0;
+
     audio::TrackSequenceId m_currentSequenceId = -1;
     async::Notification m_currentSequenceIdChanged;
     audio::PlaybackStatus m_currentPlaybackStatus = audio::PlaybackStatus::Stopped;
     midi::tick_t m_currentTick = 0;
 
-    std::unordered_map<engraving::InstrumentTrackId, audio::TrackId> m_trackIdMap;
+    FlatHashMap<engraving::InstrumentTrackId, audio::TrackId> m_trackIdMap;
+    FlatHashMap<audio::TrackId, engraving::InstrumentTrackId> m_trackIdReverseMap;
+
+    std::vector<TrackMutation> m_trackMutations;
+    bool m_trackMutationsFlushPending = false;
 };
 }
 
@@ -59,7 +59,7 @@ public:
     virtual bool actionChecked(const actions::ActionCode& actionCode) const = 0;
     virtual async::Channel<actions::ActionCode> actionCheckedChanged() const = 0;
 
-    virtual QTime totalPlayTime() const = 0;
+    virtual audio::msecs_t totalPlayTimeMsecs() const = 0;
 
     virtual notation::Tempo currentTempo() const = 0;
     virtual notation::MeasureBeat currentBeat() const = 0;
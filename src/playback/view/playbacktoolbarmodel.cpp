@@ -208,12 +208,13 @@ void PlaybackToolBarModel::setPlayPosition(qreal position)
 
 QTime PlaybackToolBarModel::totalPlayTime() const
 {
-    return playbackController()->totalPlayTime();
+    //! NOTE the controller reports plain milliseconds, QTime is only built here at the binding layer
+    return timeFromMilliseconds(playbackController()->totalPlayTimeMsecs());
 }
 
 uint64_t PlaybackToolBarModel::totalPlayTimeMilliseconds() const
 {
-    return timeToMilliseconds(totalPlayTime());
+    return playbackController()->totalPlayTimeMsecs();
 }
 
 MeasureBeat PlaybackToolBarModel::measureBeat() const